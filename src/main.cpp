@@ -8,6 +8,15 @@
 
 #define RELAY_PIN 2  // GPIO2 on ESP32-C3 Super Mini
 
+// WiFi link watchdog timing
+#define WIFI_FAST_CONNECT_TIMEOUT_MS 4000   // Cached BSSID/channel attempt
+#define WIFI_CONNECT_TIMEOUT_MS 10000       // Full scan attempt
+#define WIFI_BACKOFF_MIN_MS 5000
+#define WIFI_BACKOFF_MAX_MS 300000          // 5 minutes
+#define WIFI_SETUP_AP_BACKOFF_MS 60000      // Minimum backoff while the setup AP is up
+#define WIFI_SETUP_AP_HOLDOFF_MS 180000     // Pause retries while setup AP has clients
+#define WIFI_CACHE_STATIC_IP 0              // 1 = reuse last DHCP lease as static IP
+
 // Configuration structure
 struct Config {
   char wifi_ssid[32];
@@ -28,8 +37,42 @@ WebServer server(80);
 bool relay_state = false;
 time_t sunset_trigger_time = 0;
 bool relay_scheduled = false;
+int armed_yday = -1;  // Local day of year the relay-on trigger was last armed for
 String last_sunset_time = "";
 unsigned long last_fetch = 0;
+bool sunset_stale = true;  // True until today's sunset has been fetched from the API
+unsigned long sunset_next_retry = 0;
+unsigned long sunset_retry_ms = WIFI_BACKOFF_MIN_MS;
+
+// Last successful association, cached in NVS so reconnects can skip the scan
+struct WiFiCache {
+  uint8_t bssid[6];
+  int32_t channel;
+  uint32_t ip;
+  uint32_t gateway;
+  uint32_t subnet;
+  uint32_t dns;
+  bool valid;
+};
+
+WiFiCache wifi_cache;
+
+// WiFi link watchdog state
+bool wifi_link_up = false;
+bool wifi_connecting = false;
+bool wifi_use_cache = true;
+bool wifi_attempt_fast = false;
+unsigned long wifi_attempt_started = 0;
+unsigned long wifi_cycle_started = 0;  // First attempt of the current (re)connect cycle
+unsigned long wifi_down_since = 0;
+unsigned long wifi_next_attempt = 0;
+unsigned long wifi_backoff_ms = WIFI_BACKOFF_MIN_MS;
+
+// WiFi link statistics
+unsigned long wifi_reconnects = 0;
+unsigned long wifi_last_connect_ms = 0;
+unsigned long wifi_offline_total_s = 0;
+unsigned long wifi_offline_longest_s = 0;
 
 // Days of week names
 const char* dayNames[] = {"Sunday", "Monday", "Tuesday", "Wednesday", "Thursday", "Friday", "Saturday"};
@@ -148,6 +191,7 @@ input:focus{outline:none;border-color:#667eea}
 <p><strong>Next Sunset:</strong> <span id='nextSunset'>--</span></p>
 <p><strong>Relay ON Time:</strong> <span id='relayOn'>--</span></p>
 <p><strong>Relay OFF Time:</strong> <span id='relayOff'>--</span></p>
+<p><strong>WiFi:</strong> <span id='wifiStatus'>--</span></p>
 </div>
 </div>
 <script>
@@ -161,6 +205,12 @@ document.getElementById('today').textContent=d.today||'--';
 document.getElementById('nextSunset').textContent=d.next_sunset||'--';
 document.getElementById('relayOn').textContent=d.relay_on_time||'--';
 document.getElementById('relayOff').textContent=d.relay_off_time||'--';
+if(d.wifi){
+document.getElementById('wifiStatus').textContent=(d.wifi.connected
+?'Connected ('+d.wifi.rssi+' dBm, '+d.wifi.last_connect_ms+' ms)'
+:'Offline for '+d.wifi.offline_now_s+' s')
++' - '+d.wifi.reconnects+' reconnects, '+d.wifi.offline_total_s+' s offline total';
+}
 if(d.ssid)document.getElementById('ssid').value=d.ssid;
 if(d.lat)document.getElementById('lat').value=d.lat;
 if(d.lng)document.getElementById('lng').value=d.lng;
@@ -262,6 +312,9 @@ void loadConfig() {
     config.turnoff_minute[i] = preferences.getInt(key_min, 0);
   }
   
+  // Last fetched sunset trigger, so the schedule survives an offline reboot
+  sunset_trigger_time = (time_t)preferences.getLong64("sunset_trigger", 0);
+  
   preferences.end();
   
   Serial.println("Configuration loaded from memory");
@@ -293,6 +346,70 @@ void saveConfig() {
   Serial.println("Configuration saved to memory");
 }
 
+// Save the last fetched sunset trigger time
+void saveSunsetTrigger() {
+  preferences.begin("relay-config", false);
+  preferences.putLong64("sunset_trigger", (int64_t)sunset_trigger_time);
+  preferences.end();
+}
+
+// Load cached BSSID/channel for the configured SSID
+void loadWiFiCache() {
+  wifi_cache.valid = false;
+  preferences.begin("wifi-cache", true);
+
+  char ssid[32] = "";
+  preferences.getString("ssid", ssid, sizeof(ssid));
+
+  // Only trust the cache if it belongs to the network we are joining
+  if (strlen(ssid) > 0 && strcmp(ssid, config.wifi_ssid) == 0 &&
+      preferences.getBytes("bssid", wifi_cache.bssid, sizeof(wifi_cache.bssid)) == sizeof(wifi_cache.bssid)) {
+    wifi_cache.channel = preferences.getInt("channel", 0);
+    wifi_cache.ip = preferences.getUInt("ip", 0);
+    wifi_cache.gateway = preferences.getUInt("gateway", 0);
+    wifi_cache.subnet = preferences.getUInt("subnet", 0);
+    wifi_cache.dns = preferences.getUInt("dns", 0);
+    wifi_cache.valid = wifi_cache.channel > 0;
+  }
+
+  preferences.end();
+}
+
+// Cache the current association, writing to flash only when it changed
+void saveWiFiCache() {
+  WiFiCache current;
+  memcpy(current.bssid, WiFi.BSSID(), sizeof(current.bssid));
+  current.channel = WiFi.channel();
+  current.ip = (uint32_t)WiFi.localIP();
+  current.gateway = (uint32_t)WiFi.gatewayIP();
+  current.subnet = (uint32_t)WiFi.subnetMask();
+  current.dns = (uint32_t)WiFi.dnsIP();
+  current.valid = true;
+
+  if (wifi_cache.valid &&
+      memcmp(current.bssid, wifi_cache.bssid, sizeof(current.bssid)) == 0 &&
+      current.channel == wifi_cache.channel &&
+      current.ip == wifi_cache.ip &&
+      current.gateway == wifi_cache.gateway &&
+      current.subnet == wifi_cache.subnet &&
+      current.dns == wifi_cache.dns) {
+    return;
+  }
+
+  preferences.begin("wifi-cache", false);
+  preferences.putString("ssid", config.wifi_ssid);
+  preferences.putBytes("bssid", current.bssid, sizeof(current.bssid));
+  preferences.putInt("channel", current.channel);
+  preferences.putUInt("ip", current.ip);
+  preferences.putUInt("gateway", current.gateway);
+  preferences.putUInt("subnet", current.subnet);
+  preferences.putUInt("dns", current.dns);
+  preferences.end();
+
+  wifi_cache = current;
+  Serial.printf("WiFi cache updated (channel %d, BSSID %s)\n", current.channel, WiFi.BSSIDstr().c_str());
+}
+
 // HTTP handler for main page
 void handleRoot() {
   server.send_P(200, "text/html", html_page);
@@ -316,7 +433,7 @@ void handleStatus() {
            config.turnoff_hour[day_of_week], 
            config.turnoff_minute[day_of_week]);
   
-  StaticJsonDocument<768> doc;
+  StaticJsonDocument<1024> doc;
   doc["relay"] = relay_state;
   doc["current_time"] = time_str;
   doc["today"] = dayNames[day_of_week];
@@ -334,6 +451,16 @@ void handleStatus() {
     day["min"] = config.turnoff_minute[i];
   }
   
+  JsonObject wifi = doc.createNestedObject("wifi");
+  wifi["connected"] = wifi_link_up;
+  wifi["rssi"] = wifi_link_up ? WiFi.RSSI() : 0;
+  wifi["channel"] = wifi_link_up ? WiFi.channel() : 0;
+  wifi["reconnects"] = wifi_reconnects;
+  wifi["last_connect_ms"] = wifi_last_connect_ms;
+  wifi["offline_now_s"] = wifi_link_up ? 0 : (millis() - wifi_down_since) / 1000;
+  wifi["offline_total_s"] = wifi_offline_total_s;
+  wifi["offline_longest_s"] = wifi_offline_longest_s;
+  
   if (relay_scheduled && sunset_trigger_time > 0) {
     struct tm trigger_tm;
     localtime_r(&sunset_trigger_time, &trigger_tm);
@@ -444,11 +571,49 @@ void handleSave() {
   ESP.restart();
 }
 
-// Fetch sunset time from API
-void fetchSunsetTime() {
+// Arm the relay-on trigger, moving it to tomorrow if today's turn-off time
+// has already passed (e.g. after a late boot) so the relay doesn't switch ON
+// and stay on until tomorrow's turn-off
+void armSunsetTrigger(time_t now) {
+  struct tm off_tm;
+  localtime_r(&now, &off_tm);
+  off_tm.tm_hour = config.turnoff_hour[off_tm.tm_wday];
+  off_tm.tm_min = config.turnoff_minute[off_tm.tm_wday];
+  off_tm.tm_sec = 0;
+  time_t turnoff_today = mktime(&off_tm);
+  
+  if (now >= turnoff_today && sunset_trigger_time < turnoff_today) {
+    sunset_trigger_time += 86400;
+    Serial.println("Today's turn-off time has passed - relay will turn ON tomorrow");
+  }
+  relay_scheduled = true;
+  armed_yday = off_tm.tm_yday;
+  
+  struct tm trigger_tm;
+  localtime_r(&sunset_trigger_time, &trigger_tm);
+  
+  char trigger_str[64];
+  strftime(trigger_str, sizeof(trigger_str), "%H:%M:%S CST", &trigger_tm);
+  last_sunset_time = String(trigger_str);
+  
+  Serial.print("Relay will turn ON at: ");
+  Serial.println(trigger_str);
+}
+
+// Fetch sunset time from API, returns true if a new trigger time was scheduled
+bool fetchSunsetTime() {
   if (WiFi.status() != WL_CONNECTED) {
     Serial.println("WiFi not connected, cannot fetch sunset time");
-    return;
+    sunset_stale = true;
+    return false;
+  }
+  
+  // The request and the turn-off check both need the local date
+  time_t now = time(nullptr);
+  if (now < 1000000000) {
+    Serial.println("Time not synchronized, cannot fetch sunset time");
+    sunset_stale = true;
+    return false;
   }
   
   HTTPClient http;
@@ -456,6 +621,14 @@ void fetchSunsetTime() {
                String(config.latitude, 6) + "&lng=" + 
                String(config.longitude, 6) + "&formatted=0";
   
+  // Ask for the local date; without it the API uses the UTC date,
+  // which is already tomorrow during the evening in CST
+  struct tm local_tm;
+  localtime_r(&now, &local_tm);
+  char date_str[16];
+  strftime(date_str, sizeof(date_str), "%Y-%m-%d", &local_tm);
+  url += "&date=" + String(date_str);
+  
   Serial.println("Fetching sunset time from API...");
   http.begin(url);
   int httpCode = http.GET();
@@ -487,22 +660,10 @@ void fetchSunsetTime() {
       
       // Convert to CST (UTC-6) and add delay
       sunset_trigger_time = sunset_utc - (6 * 3600) + (config.sunset_delay_minutes * 60);
-      relay_scheduled = true;
-      
-      struct tm trigger_tm;
-      localtime_r(&sunset_trigger_time, &trigger_tm);
-      
-      char trigger_str[64];
-      strftime(trigger_str, sizeof(trigger_str), "%H:%M:%S CST", &trigger_tm);
-      last_sunset_time = String(trigger_str);
-      
-      Serial.print("Relay will turn ON at: ");
-      Serial.println(trigger_str);
+      armSunsetTrigger(now);
       
       // Show turn-off time for today
-      time_t now;
       struct tm timeinfo;
-      time(&now);
       localtime_r(&now, &timeinfo);
       int day_of_week = timeinfo.tm_wday;
       
@@ -512,6 +673,10 @@ void fetchSunsetTime() {
                     dayNames[day_of_week]);
       
       last_fetch = millis();
+      sunset_stale = false;
+      saveSunsetTrigger();
+      http.end();
+      return true;
     } else {
       Serial.println("JSON parsing failed");
     }
@@ -521,11 +686,36 @@ void fetchSunsetTime() {
   }
   
   http.end();
+  sunset_stale = true;
+  return false;
 }
 
-// Initialize WiFi in AP mode
-void startAccessPoint() {
-  WiFi.mode(WIFI_AP);
+// Carry the last known sunset forward to today's date while the API is unreachable
+void reuseCachedSunset(time_t now) {
+  if (sunset_trigger_time == 0) {
+    Serial.println("No cached sunset time - relay will turn ON once the API is reachable");
+    return;
+  }
+  
+  struct tm day_tm;
+  localtime_r(&now, &day_tm);
+  day_tm.tm_hour = 0;
+  day_tm.tm_min = 0;
+  day_tm.tm_sec = 0;
+  time_t day_start = mktime(&day_tm);
+  
+  while (sunset_trigger_time < day_start) {
+    sunset_trigger_time += 86400;
+  }
+  sunset_stale = true;
+  
+  Serial.println("Using cached sunset time");
+  armSunsetTrigger(now);
+}
+
+// Initialize WiFi in AP mode (keep_station leaves STA up for the link watchdog)
+void startAccessPoint(bool keep_station = false) {
+  WiFi.mode(keep_station ? WIFI_AP_STA : WIFI_AP);
   WiFi.softAP("SunsetRelay-Setup", "12345678");
   
   Serial.println("WiFi AP started");
@@ -536,28 +726,70 @@ void startAccessPoint() {
   Serial.println("Connect to http://192.168.4.1");
 }
 
+// Start a station connection, using the cached BSSID/channel when allowed
+// Returns true if the fast (no-scan) path was used
+bool beginStation(bool use_cache) {
+  bool fast = use_cache && wifi_cache.valid;
+  
+#if WIFI_CACHE_STATIC_IP
+  if (fast && wifi_cache.ip != 0) {
+    WiFi.config(IPAddress(wifi_cache.ip), IPAddress(wifi_cache.gateway),
+                IPAddress(wifi_cache.subnet), IPAddress(wifi_cache.dns));
+  } else {
+    WiFi.config(INADDR_NONE, INADDR_NONE, INADDR_NONE);  // Back to DHCP
+  }
+#endif
+  
+  if (fast) {
+    WiFi.begin(config.wifi_ssid, config.wifi_password, wifi_cache.channel, wifi_cache.bssid, true);
+  } else {
+    WiFi.begin(config.wifi_ssid, config.wifi_password);
+  }
+  return fast;
+}
+
+// Wait (blocking) for the station to connect, used only during boot
+bool waitForStation(unsigned long timeout_ms) {
+  unsigned long start = millis();
+  int ticks = 0;
+  while (WiFi.status() != WL_CONNECTED && millis() - start < timeout_ms) {
+    delay(100);
+    if (++ticks % 5 == 0) Serial.print(".");
+  }
+  return WiFi.status() == WL_CONNECTED;
+}
+
 // Initialize WiFi in STA mode
 void connectToWiFi() {
+  WiFi.persistent(false);        // Credentials already live in our own preferences
+  WiFi.setAutoReconnect(false);  // serviceWiFiLink() owns reconnects and backoff
   WiFi.mode(WIFI_STA);
-  WiFi.begin(config.wifi_ssid, config.wifi_password);
+  
+  // Configure time with CST timezone (SNTP resyncs whenever the link is up)
+  configTime(-6 * 3600, 0, "pool.ntp.org", "time.nist.gov");
+  
+  loadWiFiCache();
   
   Serial.print("Connecting to WiFi: ");
   Serial.println(config.wifi_ssid);
   
-  int attempts = 0;
-  while (WiFi.status() != WL_CONNECTED && attempts < 20) {
-    delay(500);
-    Serial.print(".");
-    attempts++;
+  // Make a single attempt here; any fallback runs in serviceWiFiLink()
+  wifi_attempt_started = millis();
+  wifi_cycle_started = wifi_attempt_started;
+  wifi_attempt_fast = beginStation(true);
+  if (wifi_attempt_fast) {
+    Serial.printf("Fast connect using cached BSSID on channel %d\n", wifi_cache.channel);
   }
+  bool connected = waitForStation(wifi_attempt_fast ? WIFI_FAST_CONNECT_TIMEOUT_MS : WIFI_CONNECT_TIMEOUT_MS);
   
-  if (WiFi.status() == WL_CONNECTED) {
-    Serial.println("\nWiFi connected!");
+  if (connected) {
+    wifi_last_connect_ms = millis() - wifi_cycle_started;
+    wifi_link_up = true;
+    Serial.printf("\nWiFi connected in %lu ms!\n", wifi_last_connect_ms);
     Serial.print("IP address: ");
     Serial.println(WiFi.localIP());
+    saveWiFiCache();
     
-    // Configure time with CST timezone
-    configTime(-6 * 3600, 0, "pool.ntp.org", "time.nist.gov");
     Serial.println("Waiting for NTP time sync...");
     
     // Wait for time to be set
@@ -575,9 +807,122 @@ void connectToWiFi() {
     fetchSunsetTime();
   } else {
     Serial.println("\nFailed to connect to WiFi");
-    Serial.println("Starting AP mode for configuration");
-    startAccessPoint();
+    Serial.println("Starting AP mode for configuration, WiFi will keep retrying");
+    startAccessPoint(true);
+    
+    // Hand the timed-out attempt to the watchdog
+    wifi_connecting = true;
+    wifi_down_since = wifi_cycle_started;
+  }
+}
+
+// Non-blocking link watchdog, called from loop()
+// Reconnects with exponential backoff, trying the cached BSSID/channel first
+void serviceWiFiLink() {
+  unsigned long now_ms = millis();
+  
+  if (WiFi.status() == WL_CONNECTED) {
+    if (!wifi_link_up) {
+      unsigned long offline_s = (now_ms - wifi_down_since) / 1000;
+      wifi_offline_total_s += offline_s;
+      if (offline_s > wifi_offline_longest_s) {
+        wifi_offline_longest_s = offline_s;
+      }
+      wifi_last_connect_ms = now_ms - wifi_cycle_started;
+      wifi_reconnects++;
+      
+      wifi_link_up = true;
+      wifi_connecting = false;
+      wifi_use_cache = true;
+      wifi_backoff_ms = WIFI_BACKOFF_MIN_MS;
+      
+      Serial.printf("WiFi reconnected in %lu ms after %lu s offline\n", wifi_last_connect_ms, offline_s);
+      Serial.print("IP address: ");
+      Serial.println(WiFi.localIP());
+      saveWiFiCache();
+      
+      // Setup AP from a failed boot is no longer needed
+      if (WiFi.getMode() == WIFI_AP_STA) {
+        WiFi.softAPdisconnect(true);
+        Serial.println("Setup AP stopped");
+      }
+      
+      // Refresh a stale sunset right away
+      sunset_next_retry = now_ms;
+      sunset_retry_ms = WIFI_BACKOFF_MIN_MS;
+    }
+    
+    // Replace the carried-forward sunset; armSunsetTrigger() keeps a relay
+    // that already turned off today from re-arming. Failures retry with backoff
+    // Wait for SNTP to set the clock first
+    if (sunset_stale && time(nullptr) > 1000000000 &&
+        (long)(now_ms - sunset_next_retry) >= 0) {
+      if (fetchSunsetTime()) {
+        sunset_retry_ms = WIFI_BACKOFF_MIN_MS;
+      } else {
+        Serial.printf("Sunset refresh failed, retrying in %lu s\n", sunset_retry_ms / 1000);
+        sunset_next_retry = millis() + sunset_retry_ms;
+        sunset_retry_ms = min(sunset_retry_ms * 2, (unsigned long)WIFI_BACKOFF_MAX_MS);
+      }
+    }
+    return;
+  }
+  
+  if (wifi_link_up) {
+    wifi_link_up = false;
+    wifi_connecting = false;
+    wifi_use_cache = true;
+    wifi_backoff_ms = WIFI_BACKOFF_MIN_MS;
+    wifi_down_since = now_ms;
+    wifi_next_attempt = now_ms;
+    Serial.println("WiFi link lost - relay schedule continues offline");
+  }
+  
+  if (wifi_connecting) {
+    unsigned long timeout = wifi_attempt_fast ? WIFI_FAST_CONNECT_TIMEOUT_MS : WIFI_CONNECT_TIMEOUT_MS;
+    if (now_ms - wifi_attempt_started < timeout) {
+      return;
+    }
+    
+    wifi_connecting = false;
+    WiFi.disconnect();
+    
+    if (wifi_attempt_fast) {
+      // A stale cache shouldn't cost a backoff period
+      Serial.println("Cached BSSID unavailable, retrying with full scan");
+      wifi_use_cache = false;
+      wifi_next_attempt = now_ms;
+    } else {
+      // Each scan hops channels and disrupts the setup AP, so retry less often
+      if (WiFi.getMode() == WIFI_AP_STA && wifi_backoff_ms < WIFI_SETUP_AP_BACKOFF_MS) {
+        wifi_backoff_ms = WIFI_SETUP_AP_BACKOFF_MS;
+      }
+      Serial.printf("WiFi reconnect failed, next attempt in %lu s\n", wifi_backoff_ms / 1000);
+      wifi_use_cache = true;
+      wifi_next_attempt = now_ms + wifi_backoff_ms;
+      wifi_backoff_ms = min(wifi_backoff_ms * 2, (unsigned long)WIFI_BACKOFF_MAX_MS);
+    }
+    return;
   }
+  
+  if ((long)(now_ms - wifi_next_attempt) < 0) {
+    return;
+  }
+  
+  // Don't drop someone using the setup portal
+  if (WiFi.getMode() == WIFI_AP_STA && WiFi.softAPgetStationNum() > 0) {
+    Serial.printf("Setup AP in use, next WiFi attempt in %d s\n", WIFI_SETUP_AP_HOLDOFF_MS / 1000);
+    wifi_next_attempt = now_ms + WIFI_SETUP_AP_HOLDOFF_MS;
+    return;
+  }
+  
+  // A full-scan fallback after a failed cached attempt continues the same cycle
+  if (wifi_use_cache) {
+    wifi_cycle_started = now_ms;
+  }
+  wifi_attempt_fast = beginStation(wifi_use_cache);
+  wifi_attempt_started = now_ms;
+  wifi_connecting = true;
 }
 
 void setup() {
@@ -626,23 +971,34 @@ void setup() {
 void loop() {
   server.handleClient();
 
-  // Only run relay control if WiFi is connected and configured
-  if (WiFi.status() == WL_CONNECTED && config.configured) {
-    time_t now = time(nullptr);
+  // Keep the station link alive in the background
+  if (config.configured && strlen(config.wifi_ssid) > 0) {
+    serviceWiFiLink();
+  }
+
+  // Run relay control from the system clock once it has been set,
+  // even while WiFi is down
+  time_t now = time(nullptr);
+  if (config.configured && now > 1000000000) {
     struct tm timeinfo;
     localtime_r(&now, &timeinfo);
     
     int day_of_week = timeinfo.tm_wday;  // 0=Sunday, 6=Saturday
     
-    // Check if it's midnight - fetch new sunset time
-    if (timeinfo.tm_hour == 0 && timeinfo.tm_min == 0 && timeinfo.tm_sec < 2) {
-      fetchSunsetTime();
-      delay(2000); // Prevent multiple calls
+    // New day (or first pass since boot without a fresh fetch) - re-arm from
+    // the stored sunset and let serviceWiFiLink() refresh it from the API
+    if (timeinfo.tm_yday != armed_yday) {
+      armed_yday = timeinfo.tm_yday;
+      reuseCachedSunset(now);
+      sunset_stale = true;
+      sunset_next_retry = millis();
+      sunset_retry_ms = WIFI_BACKOFF_MIN_MS;
     }
     
     // Refetch if we haven't fetched in the last 24 hours
-    if (millis() - last_fetch > 86400000) { // 24 hours
-      fetchSunsetTime();
+    // (serviceWiFiLink() retries stale data with backoff)
+    if (!sunset_stale && millis() - last_fetch > 86400000) { // 24 hours
+      sunset_stale = true;
     }
     
     // Check if it's time to turn ON relay